@@ -58,31 +58,31 @@ namespace fiffiscript {
     }
 
     std::shared_ptr<Value> to_value(short i) {
-        return std::make_shared<IntValue>(i);
+        return make_value<IntValue>(i);
     }
 
     std::shared_ptr<Value> to_value(int i) {
-        return std::make_shared<IntValue>(i);
+        return make_value<IntValue>(i);
     }
 
     std::shared_ptr<Value> to_value(long i) {
-        return std::make_shared<IntValue>(i);
+        return make_value<IntValue>(i);
     }
 
     std::shared_ptr<Value> to_value(long long i) {
-        return std::make_shared<IntValue>(i);
+        return make_value<IntValue>(i);
     }
 
     std::shared_ptr<Value> to_value(float f) {
-        return std::make_shared<FloatValue>(f);
+        return make_value<FloatValue>(f);
     }
 
     std::shared_ptr<Value> to_value(double f) {
-        return std::make_shared<FloatValue>(f);
+        return make_value<FloatValue>(f);
     }
 
     std::shared_ptr<Value> to_value(char* s) {
-        return std::make_shared<StringValue>(s);
+        return make_value<StringValue>(s);
     }
 
     template<typename T>
@@ -115,6 +115,7 @@ namespace fiffiscript {
             wrong_number_of_arguments(callLoc, name, argument_types.size(), arguments.size());
         }
         void** cargs = new void*[arguments.size()];
+        stats::allocated(stats::MARSHALLING, arguments.size() * sizeof(void*));
         for(size_t i = 0; i < arguments.size(); i++) {
             if(argument_types[i] == short_type) {
                 cargs[i] = new short(arguments[i]->to_short(callLoc));
@@ -132,12 +133,14 @@ namespace fiffiscript {
                 std::string str = arguments[i]->to_string(callLoc);
                 char** cstr = new char*;
                 *cstr = new char[str.size() + 1];
+                stats::allocated(stats::MARSHALLING, str.size() + 1);
                 std::strcpy(*cstr, str.c_str());
                 cargs[i] = cstr;
             } else {
                 util::error(callLoc,
                             "Unsupported argument type in declaration of native function, ", name);
             }
+            stats::allocated(stats::MARSHALLING, argument_types[i]->size);
         }
 
         std::shared_ptr<Value> result;
@@ -145,7 +148,7 @@ namespace fiffiscript {
         if(return_type == void_type) {
             ffi_call(&cif, FFI_FN(function_handle), nullptr, cargs);
             // Make void functions return 0 because we don't have a void type in FiffiScript
-            result = std::make_shared<IntValue>(0);
+            result = make_value<IntValue>(0);
         } else if(return_type == short_type) {
             result = call_function<short>(&cif, function_handle, cargs);
         } else if(return_type == int_type) {
@@ -202,10 +205,16 @@ namespace fiffiscript {
     std::shared_ptr<Value> FunctionCall::evaluate(Environment& environment) {
         std::shared_ptr<Value> function_value = function->evaluate(environment);
         std::vector<std::shared_ptr<Value>> argument_values(arguments.size());
+        if(arguments.size() > 0) {
+            stats::allocated(stats::ARGUMENT_VECTORS, arguments.size() * sizeof(std::shared_ptr<Value>));
+        }
         for(size_t i=0; i < arguments.size(); i++) {
             argument_values[i] = arguments[i]->evaluate(environment);
         }
-        return function_value->call(loc, argument_values, environment);
+        stats::enter_call();
+        std::shared_ptr<Value> result = function_value->call(loc, argument_values, environment);
+        stats::leave_call();
+        return result;
     }
 
     std::shared_ptr<Value> RegularFunction::call(const yy::location& callLoc,
@@ -222,7 +231,7 @@ namespace fiffiscript {
         // Otherwise the result of the last expression is returned
         std::shared_ptr<Value> result;
         if(body.size() == 0) {
-            result = std::make_shared<IntValue>(0);
+            result = make_value<IntValue>(0);
         } else {
             for(size_t i = 0; i < body.size() - 1; i++) {
                 body[i]->evaluate(environment);
@@ -241,7 +250,9 @@ namespace fiffiscript {
         }
         if(environment["main"]) {
             std::vector<std::shared_ptr<fiffiscript::Value>> no_arguments;
+            stats::enter_call();
             environment["main"]->call(loc, no_arguments, environment);
+            stats::leave_call();
         } else {
             error("Function main() not found");
         }
@@ -8,19 +8,42 @@
 #include <ffi.h>
 
 #include "util.hh"
+#include "stats.hh"
 
 namespace fiffiscript {
     class Value;
 
+    // Like std::make_shared, but records the allocation (including the
+    // control block) under the given statistics category
+    template<typename T, stats::Category C, typename ...Args>
+    std::shared_ptr<T> make_counted(Args&&... args) {
+        return std::allocate_shared<T>(stats::Allocator<T, C>(), std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename ...Args>
+    std::shared_ptr<T> make_value(Args&&... args) {
+        return make_counted<T, stats::VALUES>(std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename ...Args>
+    std::shared_ptr<T> make_node(Args&&... args) {
+        return make_counted<T, stats::AST_NODES>(std::forward<Args>(args)...);
+    }
+
     class Environment {
-        typedef std::map<std::string, std::shared_ptr<Value>> Scope;
-        std::vector<Scope> scopes;
+        typedef std::map<std::string,
+                         std::shared_ptr<Value>,
+                         std::less<std::string>,
+                         stats::Allocator<std::pair<const std::string, std::shared_ptr<Value>>,
+                                          stats::SCOPES>> Scope;
+        std::vector<Scope, stats::Allocator<Scope, stats::SCOPES>> scopes;
     public:
         Environment() {
             push_scope();
         }
 
         void push_scope() {
+            stats::scope_pushed();
             scopes.emplace_back();
         }
 
@@ -1,17 +1,33 @@
+#include <cstring>
+
 #include "parser.tab.hh"
 #include "fiffiscript.hh"
 #include "tokenizer.hh"
+#include "stats.hh"
+#include "util.hh"
 
 int main(int argc, char** argv) {
-    if(argc < 2) {
+    const char* filename = nullptr;
+    for(int i = 1; i < argc; i++) {
+        if(std::strcmp(argv[i], "--stats") == 0) {
+            stats::enable();
+        } else if(argv[i][0] == '-') {
+            util::error("Unknown option: ", argv[i]);
+        } else if(filename != nullptr) {
+            util::error("Expected at most one source file, but got ", filename, " and ", argv[i]);
+        } else {
+            filename = argv[i];
+        }
+    }
+    if(filename == nullptr) {
         tokenizer::init_stdin();
     } else {
-        tokenizer::init_file(argv[1]);
+        tokenizer::init_file(filename);
     }
     std::unique_ptr<fiffiscript::Program> program;
     yy::parser parser(program);
     parser.parse();
-    if(argc >= 2) {
+    if(filename != nullptr) {
         tokenizer::close_file();
     }
     program->run();
@@ -15,6 +15,7 @@
 #include "location.hh"
 #include "fiffiscript.hh"
 #include "util.hh"
+#include "stats.hh"
 
 #define YY_DECL yy::parser::symbol_type yylex()
 }
@@ -48,6 +49,7 @@ YY_DECL;
 program:
     definitions {
         program = std::make_unique<fiffiscript::Program>(@program, $definitions);
+        stats::allocated(stats::AST_NODES, sizeof(fiffiscript::Program));
     }
 ;
 
@@ -61,21 +63,21 @@ definitions[result]:
 
 definition:
     DEF IDENTIFIER LEFT_PAREN param_list RIGHT_PAREN LEFT_BRACE body RIGHT_BRACE {
-        auto f = std::make_shared<fiffiscript::RegularFunction>(@definition,
-                                                                $IDENTIFIER,
-                                                                $param_list,
-                                                                $body);
-        auto exp = std::make_shared<fiffiscript::Constant>(@definition, f);
+        auto f = fiffiscript::make_node<fiffiscript::RegularFunction>(@definition,
+                                                                      $IDENTIFIER,
+                                                                      $param_list,
+                                                                      $body);
+        auto exp = fiffiscript::make_node<fiffiscript::Constant>(@definition, f);
         $definition.name = $2;
         $definition.body = exp;
     } |
     DEF NATIVE library_opt type IDENTIFIER LEFT_PAREN type_list RIGHT_PAREN {
-        auto f = std::make_shared<fiffiscript::NativeFunction>(@definition,
-                                                               $library_opt,
-                                                               $IDENTIFIER,
-                                                               $type,
-                                                               $type_list);
-        auto exp = std::make_shared<fiffiscript::Constant>(@definition, f);
+        auto f = fiffiscript::make_node<fiffiscript::NativeFunction>(@definition,
+                                                                     $library_opt,
+                                                                     $IDENTIFIER,
+                                                                     $type,
+                                                                     $type_list);
+        auto exp = fiffiscript::make_node<fiffiscript::Constant>(@definition, f);
         $definition.name = $IDENTIFIER;
         $definition.body = exp;
     } |
@@ -140,25 +142,25 @@ type_list1[result]:
 expression[result]:
     primary_expression { $result = $primary_expression; } |
     expression[f] LEFT_PAREN expression_list[args] RIGHT_PAREN {
-        $result = std::make_shared<fiffiscript::FunctionCall>(@result, $f, $args);
+        $result = fiffiscript::make_node<fiffiscript::FunctionCall>(@result, $f, $args);
     }
 ;
 
 primary_expression[result]:
     INT_LITERAL {
-        auto val = std::make_shared<fiffiscript::IntValue>($INT_LITERAL);
-        $result = std::make_shared<fiffiscript::Constant>(@result, val);
+        auto val = fiffiscript::make_value<fiffiscript::IntValue>($INT_LITERAL);
+        $result = fiffiscript::make_node<fiffiscript::Constant>(@result, val);
     } |
     FLOAT_LITERAL {
-        auto val = std::make_shared<fiffiscript::FloatValue>($FLOAT_LITERAL);
-        $result = std::make_shared<fiffiscript::Constant>(@result, val);
+        auto val = fiffiscript::make_value<fiffiscript::FloatValue>($FLOAT_LITERAL);
+        $result = fiffiscript::make_node<fiffiscript::Constant>(@result, val);
     } |
     STRING_LITERAL {
-        auto val = std::make_shared<fiffiscript::StringValue>($STRING_LITERAL);
-        $result = std::make_shared<fiffiscript::Constant>(@result, val);
+        auto val = fiffiscript::make_value<fiffiscript::StringValue>($STRING_LITERAL);
+        $result = fiffiscript::make_node<fiffiscript::Constant>(@result, val);
     } |
     IDENTIFIER {
-        $result = std::make_shared<fiffiscript::Variable>(@result, $IDENTIFIER);
+        $result = fiffiscript::make_node<fiffiscript::Variable>(@result, $IDENTIFIER);
     } |
     LEFT_PAREN expression RIGHT_PAREN {
         $result = $expression;
@@ -0,0 +1,53 @@
+#include <sys/resource.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "stats.hh"
+
+std::size_t stats::allocations[stats::CATEGORY_COUNT];
+std::size_t stats::bytes[stats::CATEGORY_COUNT];
+std::size_t stats::call_depth = 0;
+std::size_t stats::max_call_depth = 0;
+std::size_t stats::scopes_pushed = 0;
+bool stats::enabled = false;
+
+void stats::enable() {
+    if(enabled) return;
+    enabled = true;
+    std::atexit(print);
+}
+
+void stats::print() {
+    static const char* const category_names[CATEGORY_COUNT] = {
+        "values",
+        "scopes",
+        "argument vectors",
+        "marshalling buffers",
+        "AST nodes"
+    };
+
+    std::size_t total_allocations = 0;
+    std::size_t total_bytes = 0;
+    std::cerr << std::left << std::setw(20) << "category"
+              << std::right << std::setw(14) << "allocations"
+              << std::setw(14) << "bytes" << std::endl;
+    for(int i = 0; i < CATEGORY_COUNT; i++) {
+        std::cerr << std::left << std::setw(20) << category_names[i]
+                  << std::right << std::setw(14) << allocations[i]
+                  << std::setw(14) << bytes[i] << std::endl;
+        total_allocations += allocations[i];
+        total_bytes += bytes[i];
+    }
+    std::cerr << std::left << std::setw(20) << "total"
+              << std::right << std::setw(14) << total_allocations
+              << std::setw(14) << total_bytes << std::endl;
+
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0) {
+        // ru_maxrss is measured in kilobytes on Linux
+        std::cerr << "peak RSS: " << usage.ru_maxrss << " KiB" << std::endl;
+    }
+    std::cerr << "max call depth: " << max_call_depth << std::endl;
+    std::cerr << "scopes pushed: " << scopes_pushed << std::endl;
+}
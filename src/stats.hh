@@ -0,0 +1,95 @@
+#ifndef STATS_HH
+#define STATS_HH
+
+#include <cstddef>
+#include <new>
+
+// Counters for the --stats command line flag. Like util, this is a class with
+// only static members, so the counters themselves can stay private.
+// Counting is unconditional and only printing is gated by the flag: each
+// update is a couple of integer additions next to a heap allocation (or a
+// call) that costs far more, and not branching on the flag keeps the counting
+// allocator stateless.
+class stats {
+public:
+    enum Category {
+        VALUES,
+        SCOPES,
+        ARGUMENT_VECTORS,
+        MARSHALLING,
+        AST_NODES,
+        CATEGORY_COUNT
+    };
+
+private:
+    static std::size_t allocations[CATEGORY_COUNT];
+    static std::size_t bytes[CATEGORY_COUNT];
+    static std::size_t call_depth;
+    static std::size_t max_call_depth;
+    static std::size_t scopes_pushed;
+    static bool enabled;
+
+    static void print();
+
+public:
+    static void allocated(Category category, std::size_t size) {
+        allocations[category]++;
+        bytes[category] += size;
+    }
+
+    static void enter_call() {
+        call_depth++;
+        if(call_depth > max_call_depth) max_call_depth = call_depth;
+    }
+
+    static void leave_call() {
+        call_depth--;
+    }
+
+    static void scope_pushed() {
+        scopes_pushed++;
+    }
+
+    // Print the statistics to cerr when the program exits (including exits
+    // caused by util::error). Calling this more than once has no further
+    // effect.
+    static void enable();
+
+    // Allocator that records every allocation it makes under the given
+    // category, so that containers and allocate_shared can be counted
+    // including their bookkeeping overhead (map nodes, control blocks etc.)
+    template<typename T, Category C>
+    struct Allocator {
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind {
+            typedef Allocator<U, C> other;
+        };
+
+        Allocator() {}
+
+        template<typename U>
+        Allocator(const Allocator<U, C>&) {}
+
+        T* allocate(std::size_t n) {
+            allocated(C, n * sizeof(T));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t) {
+            ::operator delete(p);
+        }
+
+        template<typename U>
+        bool operator==(const Allocator<U, C>&) const {
+            return true;
+        }
+
+        template<typename U>
+        bool operator!=(const Allocator<U, C>&) const {
+            return false;
+        }
+    };
+};
+#endif